@@ -0,0 +1,19 @@
+// Host stand-in for ESP-IDF esp_log.h: logging compiles to nothing unless
+// HOST_LOG is defined, so benchmarks time the firmware and not stdout.
+// Arguments are still type-checked against the format.
+#pragma once
+
+#include <stdio.h>
+
+#ifdef HOST_LOG
+#define HOST_LOG_PRINT(level, tag, fmt, ...) printf(level " (%s) " fmt "\n", tag, ##__VA_ARGS__)
+#else
+#define HOST_LOG_PRINT(level, tag, fmt, ...) \
+    do { if (0) printf(fmt, ##__VA_ARGS__); (void)(tag); } while (0)
+#endif
+
+#define ESP_LOGE(tag, fmt, ...) HOST_LOG_PRINT("E", tag, fmt, ##__VA_ARGS__)
+#define ESP_LOGW(tag, fmt, ...) HOST_LOG_PRINT("W", tag, fmt, ##__VA_ARGS__)
+#define ESP_LOGI(tag, fmt, ...) HOST_LOG_PRINT("I", tag, fmt, ##__VA_ARGS__)
+#define ESP_LOGD(tag, fmt, ...) HOST_LOG_PRINT("D", tag, fmt, ##__VA_ARGS__)
+#define ESP_LOGV(tag, fmt, ...) HOST_LOG_PRINT("V", tag, fmt, ##__VA_ARGS__)
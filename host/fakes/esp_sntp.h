@@ -0,0 +1,21 @@
+// Host stand-in for ESP-IDF esp_sntp.h, answered by the simulated NTP server
+#pragma once
+
+#include <stdint.h>
+#include <sys/time.h>
+
+#define SNTP_OPMODE_POLL 0
+
+typedef void (*sntp_sync_time_cb_t)(struct timeval* tv);
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+void esp_sntp_setoperatingmode(int operating_mode);
+void esp_sntp_setservername(uint8_t idx, const char* server);
+void esp_sntp_init(void);
+void esp_sntp_stop(void);
+void sntp_set_time_sync_notification_cb(sntp_sync_time_cb_t callback);
+#ifdef __cplusplus
+}
+#endif
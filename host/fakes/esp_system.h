@@ -0,0 +1,13 @@
+// Host stand-in for ESP-IDF esp_system.h
+#pragma once
+
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+uint32_t esp_get_free_heap_size(void);
+uint32_t esp_get_minimum_free_heap_size(void);
+#ifdef __cplusplus
+}
+#endif
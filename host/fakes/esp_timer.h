@@ -0,0 +1,13 @@
+// Host stand-in for ESP-IDF esp_timer.h: time comes from the virtual clock
+#pragma once
+
+#include <stdint.h>
+#include "esp_err.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+int64_t esp_timer_get_time(void);
+#ifdef __cplusplus
+}
+#endif
@@ -0,0 +1,22 @@
+// Host stand-in for FreeRTOS queue.h. No firmware module uses queues; the
+// IR replay test runs the queue-based IR path it replaced. Sends never
+// block: a full queue fails at once, as from an ISR.
+#pragma once
+
+#include "freertos/FreeRTOS.h"
+
+typedef struct FakeQueue* QueueHandle_t;
+
+#define errQUEUE_FULL   ((BaseType_t)0)
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+QueueHandle_t xQueueCreate(UBaseType_t length, UBaseType_t item_size);
+BaseType_t xQueueSend(QueueHandle_t queue, const void* item, TickType_t ticks_to_wait);
+BaseType_t xQueueSendFromISR(QueueHandle_t queue, const void* item, BaseType_t* higher_priority_task_woken);
+BaseType_t xQueueReceive(QueueHandle_t queue, void* buffer, TickType_t ticks_to_wait);
+void vQueueDelete(QueueHandle_t queue);
+#ifdef __cplusplus
+}
+#endif
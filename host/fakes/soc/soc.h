@@ -0,0 +1,14 @@
+// Host stand-in for ESP-IDF soc/soc.h: register writes reach the GPIO model
+#pragma once
+
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+void fake_reg_write(uint32_t reg, uint32_t value);
+#ifdef __cplusplus
+}
+#endif
+
+#define REG_WRITE(reg, value) fake_reg_write((uint32_t)(reg), (uint32_t)(value))